@@ -0,0 +1,6 @@
+#!/bin/bash
+
+$(root-config --cxx) $(root-config --cflags) \
+		     -o bench.exe \
+		     -DMAIN_PROGRAM Benchmark.C \
+		     $(root-config --libs)
@@ -0,0 +1,6 @@
+#!/bin/bash
+
+$(root-config --cxx) $(root-config --cflags) \
+		     -o ensemble.exe \
+		     -DMAIN_PROGRAM SimpleEnsemble.C \
+		     $(root-config --libs)
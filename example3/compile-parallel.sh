@@ -0,0 +1,6 @@
+#!/bin/bash
+
+$(root-config --cxx) $(root-config --cflags) \
+		     -DMAIN_PROGRAM ParallelFakeMCMC.C \
+		     $(root-config --libs) -pthread \
+		     -o parallel-fake-mcmc.exe
@@ -0,0 +1,6 @@
+#!/bin/bash
+
+$(root-config --cxx) $(root-config --cflags) \
+		     -DMAIN_PROGRAM TemperedFakeMCMC.C \
+		     $(root-config --libs) -pthread \
+		     -o tempered-fake-mcmc.exe
@@ -0,0 +1,6 @@
+#!/bin/bash
+
+mpicxx $(root-config --cflags) \
+		     -o mpi-mcmc.exe \
+		     -DMCMC_USE_MPI -DMAIN_PROGRAM DistributedMCMC.C \
+		     $(root-config --libs)